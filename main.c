@@ -2,6 +2,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stddef.h>
+
+#ifdef POOL_BENCHMARK
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
 
 #define MAX_COMMAND_LENGTH 100
 #define MAX_VAR_NAME 15
@@ -62,6 +69,161 @@ void parse_command(char* command);
 void handle_append(char* command);
 int is_valid_var_name(const char* name);
 
+// --- Memory Pools ---
+
+#define POOL_SLAB_BYTES 16384
+#define POOL_ALIGN 8
+#define POOL_ROUND(n) (((n) + POOL_ALIGN - 1) & ~(size_t)(POOL_ALIGN - 1))
+#define STRING_POOL_CLASSES 5
+#define STRING_POOL_MAX 128
+#define STRING_TAG_MALLOC 0xFF
+
+// Every string the interpreter creates comes out of a command line, so it fits the largest class with its tag
+#if MAX_COMMAND_LENGTH + 2 > STRING_POOL_MAX
+#error "STRING_POOL_MAX must cover MAX_COMMAND_LENGTH"
+#endif
+
+// An unused slot; the link overlays the object storage while it sits on the free list
+typedef struct pool_slot {
+    struct pool_slot* next;
+} PoolSlot;
+
+// Header at the start of every slab, chained so a whole pool can be released in bulk
+typedef struct pool_slab {
+    struct pool_slab* next;
+} PoolSlab;
+
+// Fixed-size object pool: slots are carved sequentially out of slabs, and freed slots are reused first
+typedef struct pool {
+    size_t obj_size;
+    PoolSlab* slabs;
+    PoolSlot* free_list;
+    char* bump;
+    char* bump_end;
+} Pool;
+
+Pool node_pool = {POOL_ROUND(sizeof(ListNode)), NULL, NULL, NULL, NULL};
+Pool var_pool = {POOL_ROUND(sizeof(Variable)), NULL, NULL, NULL, NULL};
+Pool string_pools[STRING_POOL_CLASSES] = {
+    {8, NULL, NULL, NULL, NULL},
+    {16, NULL, NULL, NULL, NULL},
+    {32, NULL, NULL, NULL, NULL},
+    {64, NULL, NULL, NULL, NULL},
+    {STRING_POOL_MAX, NULL, NULL, NULL, NULL}
+};
+
+#ifdef POOL_BENCHMARK
+// When set, pools pass straight through to malloc/free; only toggle while pools are empty
+int pool_use_malloc = 0;
+#endif
+
+void* pool_alloc(Pool* pool) {
+#ifdef POOL_BENCHMARK
+    if (pool_use_malloc) {
+        return malloc(pool->obj_size);
+    }
+#endif
+
+    if (pool->free_list) {
+        PoolSlot* slot = pool->free_list;
+        pool->free_list = slot->next;
+        return slot;
+    }
+
+    // Start a new slab once the current one is exhausted
+    if (pool->bump == NULL || pool->bump_end - pool->bump < (ptrdiff_t)pool->obj_size) {
+        PoolSlab* slab = (PoolSlab*)malloc(POOL_SLAB_BYTES);
+        if (!slab) return NULL;
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->bump = (char*)slab + POOL_ROUND(sizeof(PoolSlab));
+        pool->bump_end = (char*)slab + POOL_SLAB_BYTES;
+    }
+
+    void* obj = pool->bump;
+    pool->bump += pool->obj_size;
+    return obj;
+}
+
+void pool_free(Pool* pool, void* obj) {
+    if (!obj) return;
+
+#ifdef POOL_BENCHMARK
+    if (pool_use_malloc) {
+        free(obj);
+        return;
+    }
+#endif
+
+    PoolSlot* slot = (PoolSlot*)obj;
+    slot->next = pool->free_list;
+    pool->free_list = slot;
+}
+
+// Frees every slab at once; all objects handed out by the pool become invalid
+void pool_release(Pool* pool) {
+    PoolSlab* current = pool->slabs;
+    while (current != NULL) {
+        PoolSlab* temp = current;
+        current = current->next;
+        free(temp);
+    }
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+}
+
+void pool_release_all(void) {
+    pool_release(&node_pool);
+    pool_release(&var_pool);
+    for (int i = 0; i < STRING_POOL_CLASSES; i++) {
+        pool_release(&string_pools[i]);
+    }
+}
+
+// Strings carry a one-byte tag in front of the payload naming the class they came from,
+// so string_free never depends on what was written into the buffer
+char* string_alloc(size_t size) {
+    unsigned char* block = NULL;
+    unsigned char tag = STRING_TAG_MALLOC;
+
+    for (int i = 0; i < STRING_POOL_CLASSES; i++) {
+        if (size + 1 <= string_pools[i].obj_size) {
+            block = (unsigned char*)pool_alloc(&string_pools[i]);
+            tag = (unsigned char)i;
+            break;
+        }
+    }
+    if (tag == STRING_TAG_MALLOC) {
+        block = (unsigned char*)malloc(size + 1);
+    }
+
+    if (!block) return NULL;
+    block[0] = tag;
+    return (char*)(block + 1);
+}
+
+void string_free(char* str) {
+    if (!str) return;
+
+    unsigned char* block = (unsigned char*)str - 1;
+    if (block[0] == STRING_TAG_MALLOC) {
+        free(block);
+    } else {
+        pool_free(&string_pools[block[0]], block);
+    }
+}
+
+char* string_dup(const char* str) {
+    size_t size = strlen(str) + 1;
+    char* copy = string_alloc(size);
+    if (copy) {
+        memcpy(copy, str, size);
+    }
+    return copy;
+}
+
 
 void handle_append(char* command) {
     char* arg_start = strchr(command, '(');
@@ -104,7 +266,7 @@ void handle_append(char* command) {
     }
 
     // Create a new list node and append it
-    ListNode* newNode = (ListNode*)malloc(sizeof(ListNode));
+    ListNode* newNode = (ListNode*)pool_alloc(&node_pool);
     if (!newNode) {
         perror("Failed to allocate memory for new list node");
         free_element(&value_to_append);
@@ -132,14 +294,14 @@ void free_element(Element* elem) {
     if (!elem) return;
 
     if (elem->type == STRING) {
-        free(elem->value.string_val);
+        string_free(elem->value.string_val);
     } else if (elem->type == LIST) {
         ListNode* current = elem->value.list_val;
         while (current != NULL) {
             ListNode* temp = current;
             free_element(&temp->data);
             current = current->next;
-            free(temp);
+            pool_free(&node_pool, temp);
         }
     }
 }
@@ -156,7 +318,7 @@ Variable* find_variable(const char* name) {
 }
 
 Variable* create_variable(const char* name) {
-    Variable* new_var = (Variable*)malloc(sizeof(Variable));
+    Variable* new_var = (Variable*)pool_alloc(&var_pool);
     if (!new_var) {
         perror("Failed to allocate memory for variable");
         return NULL;
@@ -185,7 +347,7 @@ char* parse_string_literal(const char* str) {
         return NULL;
     }
 
-    char* result = (char*)malloc(MAX_STRING_LEN + 1);
+    char* result = string_alloc(MAX_STRING_LEN + 1);
     if (!result) return NULL;
 
     int j = 0;
@@ -237,7 +399,7 @@ ListNode* parse_list_literal(char* list_str) {
             if (strlen(trimmed_str) > 0) {
                 Element new_elem = evaluate_expression(trimmed_str);
                 
-                ListNode* newNode = (ListNode*)malloc(sizeof(ListNode));
+                ListNode* newNode = (ListNode*)pool_alloc(&node_pool);
                 if (!newNode) {
                     perror("Failed to allocate memory for list node");
                     free(element_str);
@@ -420,13 +582,13 @@ Element copy_element(Element original) {
             break;
         case STRING:
             if (original.value.string_val) {
-                new_elem.value.string_val = strdup(original.value.string_val);
+                new_elem.value.string_val = string_dup(original.value.string_val);
             }
             break;
         case LIST:
             // This is the crucial part: Deep copy the list
             if (original.value.list_val) {
-                new_elem.value.list_val = (ListNode*)malloc(sizeof(ListNode));
+                new_elem.value.list_val = (ListNode*)pool_alloc(&node_pool);
                 if (!new_elem.value.list_val) {
                     perror("Failed to allocate list node");
                     new_elem.type = NONE;
@@ -440,7 +602,7 @@ Element copy_element(Element original) {
 
                 original_curr = original_curr->next;
                 while (original_curr) {
-                    new_curr->next = (ListNode*)malloc(sizeof(ListNode));
+                    new_curr->next = (ListNode*)pool_alloc(&node_pool);
                     if (!new_curr->next) {
                          perror("Failed to allocate list node");
                          new_elem.type = NONE;
@@ -538,7 +700,7 @@ Element parse_operand(char* operand_str) {
         result.value.char_val = operand_str[1];
     } else if (operand_str[0] == '"' && operand_str[strlen(operand_str) - 1] == '"') {
         result.type = STRING;
-        result.value.string_val = (char*)malloc(strlen(operand_str) - 1);
+        result.value.string_val = string_alloc(strlen(operand_str) - 1);
         if (!result.value.string_val) {
             perror("Failed to allocate memory for string");
             return result;
@@ -655,10 +817,15 @@ void handle_assignment(char* command) {
         Variable* var = find_variable(lhs);
         if (!var) {
             var = create_variable(lhs);
+            if (!var) {
+                free_element(&result);
+                return;
+            }
         } else {
             free_element(&var->value);
         }
-        var->value = copy_element(result);;
+        // The evaluated result is already a fresh copy, so the variable takes ownership of it
+        var->value = result;
     }
 }
 
@@ -693,6 +860,8 @@ void parse_command(char* command) {
 
 // --- Main Loop ---
 
+#ifndef POOL_BENCHMARK
+
 int main() {
     char command[MAX_COMMAND_LENGTH + 1];
     printf("Python-like Interpreter (type 'exit' to quit)\n");
@@ -713,13 +882,126 @@ int main() {
 
         parse_command(command);
     }
-    Variable* current = var_head;
-    while (current != NULL) {
-        Variable* temp = current;
-        free_element(&temp->value);
-        current = current->next;
-        free(temp);
-    }
+    // Variables, list nodes and strings all live in the shared pools, so on exit drop every slab at once
+    pool_release_all();
+    var_head = NULL;
     
     return 0;
-}
\ No newline at end of file
+}
+
+#else
+
+// --- Allocator Benchmark ---
+// Build with -DPOOL_BENCHMARK to compare the pools against plain malloc.
+
+#define BENCH_NODES 1000000
+#define BENCH_PASSES 20
+
+// Resident set size in KB, read from /proc/self/statm (Linux only)
+long resident_kb(void) {
+    long size = 0, resident = -1;
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (!statm) return -1;
+    if (fscanf(statm, "%ld %ld", &size, &resident) != 2) resident = -1;
+    fclose(statm);
+    return resident < 0 ? -1 : resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Builds, walks and frees one large list of strings with the current allocator mode.
+ * Allocation order mirrors parse_list_literal: a scratch token buffer, the boxed payload, then the node.
+ */
+void run_benchmark(const char* label) {
+    char token[32];
+    long rss_before = resident_kb();
+
+    double start = now_seconds();
+    Element list = {LIST, {0}};
+    ListNode* tail = NULL;
+    for (long i = 0; i < BENCH_NODES; i++) {
+        int len = snprintf(token, sizeof(token), "item%ld", i);
+        char* scratch = (char*)malloc(len + 1);
+        if (!scratch) {
+            perror("Failed to allocate scratch buffer");
+            exit(1);
+        }
+        memcpy(scratch, token, len + 1);
+
+        char* payload = string_dup(scratch);
+        ListNode* newNode = (ListNode*)pool_alloc(&node_pool);
+        if (!newNode || !payload) {
+            perror("Failed to allocate list element");
+            exit(1);
+        }
+        free(scratch);
+
+        newNode->data.type = STRING;
+        newNode->data.value.string_val = payload;
+        newNode->next = NULL;
+        if (tail == NULL) {
+            list.value.list_val = newNode;
+        } else {
+            tail->next = newNode;
+        }
+        tail = newNode;
+    }
+    double build_time = now_seconds() - start;
+    long rss_after = resident_kb();
+
+    // Walk the list the way print_element does, touching each node and its payload
+    start = now_seconds();
+    unsigned long checksum = 0;
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        for (ListNode* current = list.value.list_val; current != NULL; current = current->next) {
+            checksum += (unsigned char)current->data.value.string_val[4];
+        }
+    }
+    double walk_time = (now_seconds() - start) / BENCH_PASSES;
+
+    // Free the list the way the interpreter does at runtime, node by node through free_element
+    start = now_seconds();
+    free_element(&list);
+    double free_time = now_seconds() - start;
+
+    printf("%-8s %10ld %12.2f %12.2f %12.2f   (checksum %lu)\n", label,
+           (rss_before < 0 || rss_after < 0) ? -1 : rss_after - rss_before,
+           build_time * 1e3, walk_time * 1e3, free_time * 1e3, checksum);
+
+    // The pools can also drop their slabs wholesale, which the interpreter only does at exit
+    if (!pool_use_malloc) {
+        start = now_seconds();
+        pool_release_all();
+        printf("%-8s bulk release (exit only): %.2f ms\n", label, (now_seconds() - start) * 1e3);
+    }
+}
+
+int main() {
+    printf("%ld-element string list, walk averaged over %d passes\n", (long)BENCH_NODES, BENCH_PASSES);
+    printf("%-8s %10s %12s %12s %12s\n", "mode", "rss (KB)", "build (ms)", "walk (ms)", "free (ms)");
+    fflush(stdout);
+
+    // Each mode runs in its own process so heap left behind by one cannot skew the other's RSS
+    for (int use_malloc = 0; use_malloc <= 1; use_malloc++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pid == 0) {
+            pool_use_malloc = use_malloc;
+            run_benchmark(use_malloc ? "malloc" : "pool");
+            fflush(stdout);
+            _exit(0);
+        }
+        waitpid(pid, NULL, 0);
+    }
+    return 0;
+}
+
+#endif